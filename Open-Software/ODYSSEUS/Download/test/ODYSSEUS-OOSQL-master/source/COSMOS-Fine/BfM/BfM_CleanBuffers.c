@@ -0,0 +1,552 @@
+/******************************************************************************/
+/*                                                                            */
+/*    Copyright (c) 1990-2016, KAIST                                          */
+/*    All rights reserved.                                                    */
+/*                                                                            */
+/*    Redistribution and use in source and binary forms, with or without      */
+/*    modification, are permitted provided that the following conditions      */
+/*    are met:                                                                */
+/*                                                                            */
+/*    1. Redistributions of source code must retain the above copyright       */
+/*       notice, this list of conditions and the following disclaimer.        */
+/*                                                                            */
+/*    2. Redistributions in binary form must reproduce the above copyright    */
+/*       notice, this list of conditions and the following disclaimer in      */
+/*       the documentation and/or other materials provided with the           */
+/*       distribution.                                                        */
+/*                                                                            */
+/*    3. Neither the name of the copyright holder nor the names of its        */
+/*       contributors may be used to endorse or promote products derived      */
+/*       from this software without specific prior written permission.        */
+/*                                                                            */
+/*    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS     */
+/*    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT       */
+/*    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS       */
+/*    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE          */
+/*    COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,    */
+/*    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,    */
+/*    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;        */
+/*    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER        */
+/*    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT      */
+/*    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN       */
+/*    ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE         */
+/*    POSSIBILITY OF SUCH DAMAGE.                                             */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/*                                                                            */
+/*    ODYSSEUS/COSMOS General-Purpose Large-Scale Object Storage System --    */
+/*    Fine-Granule Locking Version                                            */
+/*    Version 3.0                                                             */
+/*                                                                            */
+/*    Developed by Professor Kyu-Young Whang et al.                           */
+/*                                                                            */
+/*    Advanced Information Technology Research Center (AITrc)                 */
+/*    Korea Advanced Institute of Science and Technology (KAIST)              */
+/*                                                                            */
+/*    e-mail: odysseus.oosql@gmail.com                                        */
+/*                                                                            */
+/*    Bibliography:                                                           */
+/*    [1] Whang, K., Lee, J., Lee, M., Han, W., Kim, M., and Kim, J., "DB-IR  */
+/*        Integration Using Tight-Coupling in the Odysseus DBMS," World Wide  */
+/*        Web, Vol. 18, No. 3, pp. 491-520, May 2015.                         */
+/*    [2] Whang, K., Lee, M., Lee, J., Kim, M., and Han, W., "Odysseus: a     */
+/*        High-Performance ORDBMS Tightly-Coupled with IR Features," In Proc. */
+/*        IEEE 21st Int'l Conf. on Data Engineering (ICDE), pp. 1104-1105     */
+/*        (demo), Tokyo, Japan, April 5-8, 2005. This paper received the Best */
+/*        Demonstration Award.                                                */
+/*    [3] Whang, K., Park, B., Han, W., and Lee, Y., "An Inverted Index       */
+/*        Storage Structure Using Subindexes and Large Objects for Tight      */
+/*        Coupling of Information Retrieval with Database Management          */
+/*        Systems," U.S. Patent No.6,349,308 (2002) (Appl. No. 09/250,487     */
+/*        (1999)).                                                            */
+/*    [4] Whang, K., Lee, J., Kim, M., Lee, M., Lee, K., Han, W., and Kim,    */
+/*        J., "Tightly-Coupled Spatial Database Features in the               */
+/*        Odysseus/OpenGIS DBMS for High-Performance," GeoInformatica,        */
+/*        Vol. 14, No. 4, pp. 425-446, Oct. 2010.                             */
+/*    [5] Whang, K., Lee, J., Kim, M., Lee, M., and Lee, K., "Odysseus: a     */
+/*        High-Performance ORDBMS Tightly-Coupled with Spatial Database       */
+/*        Features," In Proc. 23rd IEEE Int'l Conf. on Data Engineering       */
+/*        (ICDE), pp. 1493-1494 (demo), Istanbul, Turkey, Apr. 16-20, 2007.   */
+/*                                                                            */
+/******************************************************************************/
+/*
+ * Module: BfM_CleanBuffers.c
+ *
+ * Description :
+ *  Buffer cleaner run by the demon process. It writes the dirty buffers
+ *  lying just ahead of the victim pointer so that bfm_allocBuffer() finds
+ *  clean victims and need not write them in the foreground.
+ *
+ * Exports:
+ *  Four BfM_InitCleaner(Four)
+ *  Four BfM_FinalCleaner(Four)
+ *  Four BfM_CleanBuffers(Four, Four)
+ */
+
+
+#include <stdlib.h>  /* for malloc, qsort */
+#include <string.h>  /* for memcpy */
+#include "common.h"
+#include "error.h"
+#include "trace.h"
+#include "latch.h"
+#include "SHM.h"
+#include "RDsM.h"
+#include "LOG.h"
+#include "BfM.h"
+#include "perProcessDS.h"
+#include "perThreadDS.h"
+
+
+/* internal function prototypes */
+static int bfm_compareCleanEntries(const void*, const void*);
+static Four bfm_writeCleanEntries(Four, Four, BufTBLEntry**, Four);
+static Four bfm_unpinCleanEntries(Four, Four, BufTBLEntry**, Four, BfMHashKey*, Boolean);
+
+
+
+/*@================================
+ * BfM_InitCleaner()
+ *================================*/
+/*
+ * Function: Four BfM_InitCleaner(Four)
+ *
+ * Description :
+ *  Prepare the calling handle to clean the buffer pools and turn on the
+ *  buffer cleaner. This is called once by the demon process.
+ *  Because the demon is forked from a server process, it gets its own
+ *  lock control blocks for bfm_lock() instead of sharing those of the
+ *  inherited handle.
+ *
+ * Returns :
+ *  error codes
+ */
+Four BfM_InitCleaner(
+    Four handle)
+{
+    Four e;			/* for errors */
+    Four maxCleanBufs;		/* max # of buffers pinned during a pass */
+    Lock_ctrlBlock *lock_cb1, *lock_cb2;
+
+    /* pointer for BfM Data Structure of perThreadTable */
+    BfM_PerThreadDS_T *bfm_perThreadDSptr = BfM_PER_THREAD_DS_PTR(handle);
+
+
+    TR_PRINT(handle, TR_BFM, TR1, ("BfM_InitCleaner()"));
+
+
+    /* nothing to do if the cleaner was configured off */
+    if (BI_NCLEANBUFS(PAGE_BUF) <= 0 && BI_NCLEANBUFS(TRAIN_BUF) <= 0) return(eNOERROR);
+
+    /*@ get the own lock control blocks */
+    e = Util_getElementFromPool(handle, &BI_LOCK_CB_POOL(PAGE_BUF), &lock_cb1);
+    if (e < eNOERROR) ERR(handle, e);
+
+    SHM_initLatch(handle, &lock_cb1->latch);
+
+    e = Util_getElementFromPool(handle, &BI_LOCK_CB_POOL(PAGE_BUF), &lock_cb2);
+    if (e < eNOERROR) ERR(handle, e);
+
+    SHM_initLatch(handle, &lock_cb2->latch);
+
+    lock_cb2->nextHashChain = NULL;
+    lock_cb1->nextHashChain = lock_cb2;
+
+    bfm_perThreadDSptr->myLCB = lock_cb1;
+
+    /*@ allocate the work area */
+    maxCleanBufs = MAX(BI_NCLEANBUFS(PAGE_BUF), BI_NCLEANBUFS(TRAIN_BUF));
+
+    bfm_perThreadDSptr->cleanEntries = (BufTBLEntry **)malloc(sizeof(BufTBLEntry*)*maxCleanBufs);
+    if (bfm_perThreadDSptr->cleanEntries == NULL) ERR(handle, eMEMORYALLOCERR);
+
+    /* the write buffer is aligned on PAGESIZE not to be copied again by RDsM */
+    bfm_perThreadDSptr->cleanBuf = (char *)malloc(CFG_BFMCLEANERBATCHSIZE*TRAINSIZE + PAGESIZE);
+    if (bfm_perThreadDSptr->cleanBuf == NULL) {
+	free(bfm_perThreadDSptr->cleanEntries);
+	bfm_perThreadDSptr->cleanEntries = NULL;
+	ERR(handle, eMEMORYALLOCERR);
+    }
+
+    bfm_perThreadDSptr->alignedCleanBuf = (char *)(((MEMORY_ALIGN_TYPE)bfm_perThreadDSptr->cleanBuf + PAGESIZE - 1) &
+						   ~((MEMORY_ALIGN_TYPE)PAGESIZE - 1));
+
+    /*@ now bfm_allocBuffer() leaves the dirty victims to us */
+    BFM_CLEANER_ON = TRUE;
+
+    return(eNOERROR);
+
+}  /* BfM_InitCleaner */
+
+
+
+/*@================================
+ * BfM_FinalCleaner()
+ *================================*/
+/*
+ * Function: Four BfM_FinalCleaner(Four)
+ *
+ * Description :
+ *  Turn off the buffer cleaner and free its work area.
+ *
+ * Returns :
+ *  error codes
+ */
+Four BfM_FinalCleaner(
+    Four handle)
+{
+    /* pointer for BfM Data Structure of perThreadTable */
+    BfM_PerThreadDS_T *bfm_perThreadDSptr = BfM_PER_THREAD_DS_PTR(handle);
+
+
+    TR_PRINT(handle, TR_BFM, TR1, ("BfM_FinalCleaner()"));
+
+
+    BFM_CLEANER_ON = FALSE;
+
+    if (bfm_perThreadDSptr->cleanEntries != NULL) free(bfm_perThreadDSptr->cleanEntries);
+    if (bfm_perThreadDSptr->cleanBuf != NULL) free(bfm_perThreadDSptr->cleanBuf);
+
+    bfm_perThreadDSptr->cleanEntries = NULL;
+    bfm_perThreadDSptr->cleanBuf = NULL;
+    bfm_perThreadDSptr->alignedCleanBuf = NULL;
+
+    return(eNOERROR);
+
+}  /* BfM_FinalCleaner */
+
+
+
+/*@================================
+ * BfM_CleanBuffers()
+ *================================*/
+/*
+ * Function: Four BfM_CleanBuffers(Four, Four)
+ *
+ * Description :
+ *  Write the dirty buffers among the BI_NCLEANBUFS(type) buffers following
+ *  the victim pointers, i.e., the buffers the second chance algorithm will
+ *  examine next. The buffers are divided among the partitions in proportion
+ *  to their sizes. Only unfixed buffers whose reference bit is cleared are
+ *  written; a referenced buffer gets its second chance anyway.
+ *
+ *  The selected buffers are pinned by setting their fixed counters, sorted by
+ *  their train identifiers, and each run of contiguous trains is written by
+ *  one RDsM_WriteTrains() call of at most CFG_BFMCLEANERBATCHSIZE trains.
+ *  The log records are flushed up to the largest page LSN of the run before
+ *  the write (Write-Ahead-Logging).
+ *
+ *  A buffer is latched in shared mode while it is written so that nobody can
+ *  update it. The latch is requested conditionally; a busy buffer is simply
+ *  left dirty for the next pass.
+ *
+ * Returns :
+ *  error codes
+ */
+Four BfM_CleanBuffers(
+    Four handle,
+    Four type)			/* IN buffer type */
+{
+    Four e;			/* for errors */
+    Four i, p;			/* loop index */
+    Four nWindow;		/* # of buffers examined in a partition */
+    Four nCandidates;		/* # of pinned buffers */
+    Four nRun;			/* # of trains in the current run */
+    Four maxRun;		/* max # of trains written at once */
+    UFour hand;			/* start of the examined buffers */
+    bfmPartition *part;		/* a partition of the buffer pool */
+    BufTBLEntry *anEntry;	/* a buffer table entry */
+    BufTBLEntry **cleanEntries;	/* pinned buffers */
+    BfMHashKey localKey;	/* local key to lock the buffer */
+
+    /* pointer for BfM Data Structure of perThreadTable */
+    BfM_PerThreadDS_T *bfm_perThreadDSptr = BfM_PER_THREAD_DS_PTR(handle);
+
+
+    TR_PRINT(handle, TR_BFM, TR1, ("BfM_CleanBuffers(type=%ld)", type));
+
+
+    /*@ check parameters */
+    if (IS_BAD_BUFFERTYPE(type)) ERR(handle, eBADBUFFERTYPE_BFM);
+
+    if (!BFM_IS_CLEANED_BY_DEMON(type) || bfm_perThreadDSptr->cleanEntries == NULL) return(eNOERROR);
+
+    cleanEntries = bfm_perThreadDSptr->cleanEntries;
+    maxRun = MAX(CFG_BFMCLEANERBATCHSIZE*TRAINSIZE2/BI_BUFSIZE(type), 1);
+
+
+    /*@
+     * Pin the dirty buffers ahead of the victim pointers.
+     */
+    nCandidates = 0;
+
+    for (p = 0; p < BI_NPARTITIONS(type); p++) {
+
+	part = &BI_PARTITION(type, p);
+	hand = part->nextVictim;
+	nWindow = BI_NCLEANBUFS(type)*part->nBufs/BI_NBUFS(type);
+
+	for (i = 0; i < nWindow; i++) {
+
+	    anEntry = &BI_BTENTRY(type, part->firstBuf + ((hand + i) % part->nBufs));
+
+	    /* rough check without the lock; it is checked again below */
+	    if (anEntry->fixed > 0 || anEntry->referFlag || !anEntry->dirtyFlag ||
+		anEntry->invalidFlag || IS_NILBFMHASHKEY(anEntry->key)) continue;
+
+	    localKey = anEntry->key;
+	    e = bfm_lock(handle, (TrainID *)&localKey, type);
+	    if (e < eNOERROR) {
+		ERROR_PASS(handle, bfm_unpinCleanEntries(handle, type, cleanEntries, nCandidates, NULL, FALSE));
+		ERR(handle, e);
+	    }
+
+	    if (EQUALKEY(&anEntry->key, &localKey) && anEntry->fixed <= 0 &&
+		anEntry->dirtyFlag && !anEntry->invalidFlag) {
+
+		/* pin the buffer not to be replaced while it is written */
+		anEntry->fixed = 1;
+		cleanEntries[nCandidates++] = anEntry;
+	    }
+
+	    e = bfm_unlock(handle, (TrainID *)&localKey, type);
+	    if (e < eNOERROR) {
+		ERROR_PASS(handle, bfm_unpinCleanEntries(handle, type, cleanEntries, nCandidates, NULL, FALSE));
+		ERR(handle, e);
+	    }
+	}
+    }
+
+    if (nCandidates == 0) return(eNOERROR);
+
+
+    /*@
+     * Write the runs of contiguous trains.
+     */
+    qsort(cleanEntries, nCandidates, sizeof(BufTBLEntry*), bfm_compareCleanEntries);
+
+    for (i = 0; i < nCandidates; i += nRun) {
+
+	/* latch the trains of the run */
+	for (nRun = 0; i + nRun < nCandidates && nRun < maxRun; nRun++) {
+
+	    anEntry = cleanEntries[i + nRun];
+
+	    if (nRun > 0 &&
+		(anEntry->key.volNo != cleanEntries[i]->key.volNo ||
+		 anEntry->key.pageNo != cleanEntries[i]->key.pageNo + nRun*BI_BUFSIZE(type))) break;
+
+	    e = SHM_getLatch(handle, &anEntry->latch, procIndex, M_SHARED, M_CONDITIONAL, NULL);
+	    if (e < eNOERROR) {
+		ERROR_PASS(handle, bfm_unpinCleanEntries(handle, type, &cleanEntries[i], nRun, NULL, TRUE));
+		ERROR_PASS(handle, bfm_unpinCleanEntries(handle, type, &cleanEntries[i+nRun], nCandidates-i-nRun, NULL, FALSE));
+		ERR(handle, e);
+	    }
+
+	    if (e == SHM_BUSYLATCH) break;
+	}
+
+	/* somebody is using the first train; leave it for the next pass */
+	if (nRun == 0) {
+	    ERROR_PASS(handle, bfm_unpinCleanEntries(handle, type, &cleanEntries[i], 1, NULL, FALSE));
+	    nRun = 1;
+	    continue;
+	}
+
+	e = bfm_writeCleanEntries(handle, type, &cleanEntries[i], nRun);
+	if (e < eNOERROR) {
+	    ERROR_PASS(handle, bfm_unpinCleanEntries(handle, type, &cleanEntries[i], nRun, NULL, TRUE));
+	    ERROR_PASS(handle, bfm_unpinCleanEntries(handle, type, &cleanEntries[i+nRun], nCandidates-i-nRun, NULL, FALSE));
+	    ERR(handle, e);
+	}
+
+	/* clear the dirty bits and release the trains */
+	e = bfm_unpinCleanEntries(handle, type, &cleanEntries[i], nRun, &cleanEntries[i]->key, TRUE);
+	if (e < eNOERROR) {
+	    ERROR_PASS(handle, bfm_unpinCleanEntries(handle, type, &cleanEntries[i+nRun], nCandidates-i-nRun, NULL, FALSE));
+	    ERR(handle, e);
+	}
+    }
+
+    return(eNOERROR);
+
+}  /* BfM_CleanBuffers */
+
+
+
+/*@================================
+ * bfm_compareCleanEntries()
+ *================================*/
+/*
+ * Function: int bfm_compareCleanEntries(const void*, const void*)
+ *
+ * Description :
+ *  Compare two buffer table entries by their train identifiers.
+ *  This is the comparison function for qsort().
+ *
+ * Returns :
+ *  negative, zero, or positive
+ */
+static int bfm_compareCleanEntries(
+    const void *p1,		/* IN pointer to a buffer table entry pointer */
+    const void *p2)		/* IN pointer to a buffer table entry pointer */
+{
+    BufTBLEntry *e1 = *(BufTBLEntry **)p1;
+    BufTBLEntry *e2 = *(BufTBLEntry **)p2;
+
+
+    if (e1->key.volNo != e2->key.volNo) return((e1->key.volNo < e2->key.volNo) ? -1 : 1);
+    if (e1->key.pageNo != e2->key.pageNo) return((e1->key.pageNo < e2->key.pageNo) ? -1 : 1);
+
+    return(0);
+
+}  /* bfm_compareCleanEntries */
+
+
+
+/*@================================
+ * bfm_writeCleanEntries()
+ *================================*/
+/*
+ * Function: Four bfm_writeCleanEntries(Four, Four, BufTBLEntry**, Four)
+ *
+ * Description :
+ *  Write a run of contiguous trains which are pinned and latched by the
+ *  buffer cleaner. The log is flushed up to the largest page LSN first.
+ *
+ * Returns :
+ *  error codes
+ */
+static Four bfm_writeCleanEntries(
+    Four handle,
+    Four type,			/* IN buffer type */
+    BufTBLEntry **entries,	/* IN buffers of contiguous trains */
+    Four nEntries)		/* IN # of buffers */
+{
+    Four e;			/* for errors */
+    Four i;			/* loop index */
+    PageHdr_T *pageHdr;		/* page header */
+    PageHdr_T *maxLsnPageHdr;	/* page header with the largest LSN */
+
+    /* pointer for BfM Data Structure of perThreadTable */
+    BfM_PerThreadDS_T *bfm_perThreadDSptr = BfM_PER_THREAD_DS_PTR(handle);
+
+
+    /*
+     * Implements Write-Ahead-Logging: flush log records.
+     */
+    maxLsnPageHdr = (PageHdr_T*)BI_BUFFER(type, entries[0]);
+    for (i = 1; i < nEntries; i++) {
+	pageHdr = (PageHdr_T*)BI_BUFFER(type, entries[i]);
+	if (LSN_CMP_GT(pageHdr->lsn, maxLsnPageHdr->lsn)) maxLsnPageHdr = pageHdr;
+    }
+
+    e = LOG_FlushLogRecords(handle, &maxLsnPageHdr->lsn, maxLsnPageHdr->logRecLen);
+    if (e < eNOERROR) ERR(handle, e);
+
+    /*
+     * A single train is written from the buffer itself.
+     */
+    if (nEntries == 1) {
+	e = RDsM_WriteTrain(handle, BI_BUFFER(type, entries[0]), (PageID *)&entries[0]->key, BI_BUFSIZE(type));
+	if (e < eNOERROR) ERR(handle, e);
+
+	return(eNOERROR);
+    }
+
+    /*
+     * Gather the trains and write them at once.
+     */
+    for (i = 0; i < nEntries; i++)
+	memcpy(bfm_perThreadDSptr->alignedCleanBuf + i*BI_BUFSIZE(type)*PAGESIZE,
+	       BI_BUFFER(type, entries[i]), BI_BUFSIZE(type)*PAGESIZE);
+
+    e = RDsM_WriteTrains(handle, bfm_perThreadDSptr->alignedCleanBuf, (PageID *)&entries[0]->key,
+			 nEntries, BI_BUFSIZE(type));
+    if (e < eNOERROR) ERR(handle, e);
+
+    return(eNOERROR);
+
+}  /* bfm_writeCleanEntries */
+
+
+
+/*@================================
+ * bfm_unpinCleanEntries()
+ *================================*/
+/*
+ * Function: Four bfm_unpinCleanEntries(Four, Four, BufTBLEntry**, Four, BfMHashKey*, Boolean)
+ *
+ * Description :
+ *  Release the buffers pinned by the buffer cleaner. If 'writtenKey' is
+ *  not NULL, the buffers were written starting from that train; their
+ *  dirty bits are cleared and their recovery LSNs are advanced.
+ *  The dirty bit is cleared before the shared latch is released so that
+ *  an update made after the write is never lost.
+ *  If a buffer has been replaced meanwhile (e.g., by BfM_RemoveTrain()),
+ *  it is left untouched.
+ *
+ * Returns :
+ *  error codes
+ */
+static Four bfm_unpinCleanEntries(
+    Four handle,
+    Four type,			/* IN buffer type */
+    BufTBLEntry **entries,	/* IN pinned buffers */
+    Four nEntries,		/* IN # of buffers */
+    BfMHashKey *writtenKey,	/* IN first train written, or NULL */
+    Boolean latchFlag)		/* IN TRUE if the buffers are latched */
+{
+    Four e;			/* for errors */
+    Four i;			/* loop index */
+    BufTBLEntry *anEntry;	/* a buffer table entry */
+    BfMHashKey key;		/* train identifier of the written buffer */
+    BfMHashKey localKey;	/* local key to lock the buffer */
+
+
+    if (writtenKey != NULL) key = *writtenKey;
+
+    for (i = 0; i < nEntries; i++) {
+
+	anEntry = entries[i];
+	localKey = anEntry->key;
+
+	if (!IS_NILBFMHASHKEY(localKey)) {
+
+	    e = bfm_lock(handle, (TrainID *)&localKey, type);
+	    if (e < eNOERROR) ERR(handle, e);
+
+	    if (EQUALKEY(&anEntry->key, &localKey) && anEntry->fixed > 0) {
+
+		if (writtenKey != NULL && EQUALKEY(&anEntry->key, &key)) {
+		    anEntry->dirtyFlag = FALSE;
+
+		    /* the buffer is clean now; later updates have larger LSNs */
+		    e = LOG_GetNextLogRecordLsn(handle, &anEntry->recLsn);
+		    if (e < eNOERROR) {
+			anEntry->fixed--;
+			ERROR_PASS(handle, bfm_unlock(handle, (TrainID *)&localKey, type));
+			if (latchFlag) ERROR_PASS(handle, SHM_releaseLatch(handle, &anEntry->latch, procIndex));
+			ERR(handle, e);
+		    }
+		}
+
+		anEntry->fixed--;
+	    }
+
+	    e = bfm_unlock(handle, (TrainID *)&localKey, type);
+	    if (e < eNOERROR) ERR(handle, e);
+	}
+
+	if (latchFlag) {
+	    e = SHM_releaseLatch(handle, &anEntry->latch, procIndex);
+	    if (e < eNOERROR) ERR(handle, e);
+	}
+
+	if (writtenKey != NULL) key.pageNo += BI_BUFSIZE(type);
+    }
+
+    return(eNOERROR);
+
+}  /* bfm_unpinCleanEntries */
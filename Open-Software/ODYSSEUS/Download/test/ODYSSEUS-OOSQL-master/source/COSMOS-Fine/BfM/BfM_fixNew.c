@@ -162,7 +162,7 @@ Four BfM_fixNewBuffer(
 
 	/*@ allocate a buffer */
         /* Allocate a buffer from the buffer pool of type 'type' */
-        e = bfm_allocBuffer(handle, type, &anEntry);
+        e = bfm_allocBuffer(handle, type, (BfMHashKey *)trainId, &anEntry);
 
         if( e < 0 ) {  /* Buffer Allocation Error */
 	    ERROR_PASS(handle, bfm_unlock(handle, trainId, type));
@@ -160,7 +160,7 @@ Four BfM_getAndFixBuffer(
 	/*@ allocate a buffer */
         /* Allocate a buffer from the buffer pool of type 'type' */
         /* bfm_allocBuffer set the anEntry->fixed to 1 */
-        e = bfm_allocBuffer(handle, type, &anEntry);
+        e = bfm_allocBuffer(handle, type, (BfMHashKey *)trainId, &anEntry);
 
         if( e < 0 ) {  /* Buffer Allocation Error */
 	    ERROR_PASS(handle, bfm_unlock(handle, trainId, type));
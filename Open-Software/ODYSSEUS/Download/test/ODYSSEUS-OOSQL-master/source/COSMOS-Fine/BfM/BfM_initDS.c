@@ -126,6 +126,11 @@ Four BfM_initSharedDS(
     e = bfm_initBufferInfo(handle, TRAIN_BUF, TRAINSIZE2, NUM_LOT_LEAF_BUFS );
     if (e < 0) return(e);
 
+    /* the buffer cleaner is turned on by the demon process */
+    BI_NCLEANBUFS(PAGE_BUF) = MIN(CFG_BFMNUMCLEANPAGEBUFS, NUM_PAGE_BUFS);
+    BI_NCLEANBUFS(TRAIN_BUF) = MIN(CFG_BFMNUMCLEANTRAINBUFS, NUM_LOT_LEAF_BUFS);
+    BFM_CLEANER_ON = FALSE;
+
 
     return (eNOERROR);
 
@@ -158,6 +163,11 @@ Four BfM_initLocalDS(
     bfm_perThreadDSptr->MyFixed_BACB.prev = &(bfm_perThreadDSptr->MyFixed_BACB);
     bfm_perThreadDSptr->MyFixed_BACB.next = &(bfm_perThreadDSptr->MyFixed_BACB);
 
+    /* the buffer cleaner allocates these in BfM_InitCleaner() */
+    bfm_perThreadDSptr->cleanEntries = NULL;
+    bfm_perThreadDSptr->cleanBuf = NULL;
+    bfm_perThreadDSptr->alignedCleanBuf = NULL;
+
     e = Util_getElementFromPool(handle, &BI_LOCK_CB_POOL(PAGE_BUF), &lock_cb1);
     if (e < eNOERROR) ERR(handle, e);
 
@@ -201,7 +211,11 @@ Four bfm_initBufferInfo(
 {
     Four e;			/* error code */
     Four i;			/* loop index */
+    Four nPartitions;		/* # of partitions */
+    Four firstBuf;		/* first buffer of a partition */
+    Four firstHashEntry;	/* first hash table entry of a partition */
     BufTBLEntry *anEntry;	/* a Buffer Table Entry */
+    bfmPartition *part;		/* a partition of the buffer pool */
     void *physical_ptr; 
 
 
@@ -247,8 +261,30 @@ Four bfm_initBufferInfo(
 	if (e < eNOERROR) ERR(handle, e);
     }
 
-    /* initialize pointer of next victim */
-    BI_NEXTVICTIM(type) = 0;
+    /*@
+     * divide the buffer pool into partitions
+     * The buffers are evenly distributed; each partition has at least
+     * BFM_MIN_BUFS_PER_PARTITION buffers unless there is only one partition.
+     */
+    nPartitions = MIN(CFG_BFMNUMPARTITIONS, nBufs/BFM_MIN_BUFS_PER_PARTITION);
+    nPartitions = MAX(MIN(nPartitions, MAX_BFM_PARTITIONS), 1);
+    BI_NPARTITIONS(type) = nPartitions;
+
+    for (i = 0, firstBuf = 0, firstHashEntry = 0; i < nPartitions; i++) {
+
+	part = &BI_PARTITION(type, i);
+
+	/* initialize pointer of next victim */
+	part->nextVictim = 0;
+
+	part->firstBuf = firstBuf;
+	part->nBufs = nBufs/nPartitions + ((i < nBufs%nPartitions) ? 1:0);
+	part->firstHashEntry = firstHashEntry;
+	part->hashTableSize = part->nBufs*4 + 1;
+
+	firstBuf += part->nBufs;
+	firstHashEntry += part->hashTableSize;
+    }
 
     /* Initialize the hash table */
     e = bfm_initBufferHashTable(handle, type);
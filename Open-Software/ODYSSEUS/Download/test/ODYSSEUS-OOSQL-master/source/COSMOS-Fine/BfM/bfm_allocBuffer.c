@@ -95,20 +95,31 @@
  * bfm_allocBuffer()
  *================================*/
 /*
- * Function: bfm_allocBuffer(Four, BufTBLEntry**)
+ * Function: bfm_allocBuffer(Four, Four, BfMHashKey*, BufTBLEntry**)
  *
  * Description :
  *  Allocate a new buffer from the buffer pool.
- *  The used buffer pool is specified by the parameter 'type'.
+ *  The used buffer pool is specified by the parameter 'type', and the
+ *  buffer is taken from the partition of the pool to which the train
+ *  'key' belongs.
  *  This routine uses the second chance buffer replacement algorithm
  *  to select a victim.  That is, if the reference bit of current checking
- *  entry (indicated by BI_NEXTVICTIM(type), macro for
- *  bufInfo[type].nextVictim) is set, then simply clear
+ *  entry (indicated by BI_NEXTVICTIM(type, p), macro for
+ *  bufInfo[type].partition[p].nextVictim) is set, then simply clear
  *  the bit for the second chance and proceed to the next entry, otherwise
- *  the current buffer indicated by BI_NEXTVICTIM(type) is selected to be
+ *  the current buffer indicated by BI_NEXTVICTIM(type, p) is selected to be
  *  returned.
+ *  The victim pointer is advanced by an atomic fetch-and-add so that
+ *  concurrent callers examine different entries without a latch.
+ *  If no victim is found after sweeping the partition three times (the
+ *  buffers are all fixed), the next partition is tried.
  *  Before return the buffer, if the dirty bit of the victim is set, it
  *  must be force out to the disk.
+ *  When the demon process cleans the buffer pool (see BfM_CleanBuffers()),
+ *  a dirty buffer is passed over and left to the cleaner, so that the caller
+ *  does not wait for the write. Only if no clean buffer is found after
+ *  passing over as many dirty buffers as the partition has, the victim is
+ *  written here.
  *
  * Returns :
  *  1) An entry of a new buffer from the buffer pool
@@ -119,22 +130,38 @@
 Four bfm_allocBuffer(
     Four handle,
     Four type,			/* IN type of buffer (PAGE or TRAIN) */
+    BfMHashKey *key,		/* IN train to be read into the buffer */
     BufTBLEntry **victimEntry)	/* OUT a Buffer Table Entry to be victim  */
 {
     UFour j;			/* loop index */
     Four e;			/* for error */
+    Four partNo;		/* partition from which the buffer is allocated */
+    Four nExamined;		/* # of entries examined in the partition */
+    bfmPartition *part;		/* partition from which the buffer is allocated */
     BfMHashKey localKey;	/* local key to handle replaced entry */
+    Four nDirtySkipped = 0;	/* # of dirty buffers left to the buffer cleaner */
 
 
-    TR_PRINT(handle, TR_BFM, TR1, ("bfm_allocBuffer(type=%ld, victimEntry=%p)", type, victimEntry));
+    TR_PRINT(handle, TR_BFM, TR1, ("bfm_allocBuffer(type=%ld, key=%P, victimEntry=%p)", type, key, victimEntry));
 
 
-    /* THINK :: exit condition of for loop is needed ?? */
+    partNo = BFM_PARTITION(key, type);
+    part = &BI_PARTITION(type, partNo);
+
     /* starting from the NextVictim, find the victim */
+    for (nExamined = 0; ; nExamined++) {
+
+	/* all buffers of the partition seem to be fixed; try the next one */
+	if (nExamined >= 3*part->nBufs) {
+	    partNo = (partNo + 1) % BI_NPARTITIONS(type);
+	    part = &BI_PARTITION(type, partNo);
+	    nExamined = 0;
+	    nDirtySkipped = 0;
+	}
 
-    for  (j = BI_NEXTVICTIM(type)++;; j = BI_NEXTVICTIM(type)++) {
+	j = SHM_FETCH_AND_ADD(&part->nextVictim, 1);
 
-	*victimEntry = &BI_BTENTRY(type, (j % BI_NBUFS(type)));
+	*victimEntry = &BI_BTENTRY(type, part->firstBuf + (j % part->nBufs));
 
 	if ( (*victimEntry)->fixed <= 0 ) {
 
@@ -179,6 +206,13 @@ Four bfm_allocBuffer(
 
 		/* Now, Valid case */
 
+		/* leave the dirty buffer to the buffer cleaner */
+		if ( (*victimEntry)->dirtyFlag && BFM_IS_CLEANED_BY_DEMON(type) &&
+		     nDirtySkipped < part->nBufs ) {
+		    nDirtySkipped++;
+		    continue;
+		}
+
 		/* Mutex VALID Begin */
 		localKey = (*victimEntry)->key;
 		e = bfm_lock(handle, (TrainID *)&localKey, type);
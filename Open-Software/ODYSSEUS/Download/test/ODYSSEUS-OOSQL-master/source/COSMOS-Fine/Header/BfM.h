@@ -116,8 +116,15 @@ typedef PageID BfMHashKey;
 
 #define R_MOD(type) (HASHTABLESIZE(type)*3)
 
+/* A train belongs to the partition selected by its train number. */
+#define BFM_PARTITION(k, type)        \
+((UFour)((k)->volNo + (k)->pageNo/BI_BUFSIZE(type)) % BI_NPARTITIONS(type))
+
+/* hash within the partition's own range of the hash table */
 #define BFM_HASH(k, temp, type)       \
-(((k)->volNo + (k)->pageNo) % HASHTABLESIZE(type))
+(BI_PARTITION(type, BFM_PARTITION(k, type)).firstHashEntry + \
+ ((UFour)((k)->volNo + (k)->pageNo/BI_BUFSIZE(type)) / BI_NPARTITIONS(type)) % \
+ BI_PARTITION(type, BFM_PARTITION(k, type)).hashTableSize)
 
 /* If k1 = k2 then true, otherwise false */
 #define EQUALKEY(k1, k2) \
@@ -167,6 +174,22 @@ typedef struct {
 } bfmHashEntry;
 
 
+/* type definition for a partition of a buffer pool
+ * A partition is a contiguous range of the buffer table with its own
+ * victim pointer and its own range of the hash table.
+ * It is padded to the cache line size for the victim pointers of the
+ * partitions not to share a cache line.
+ */
+typedef struct {
+    UFour        nextVictim;     /* index of NextVictim in this partition */
+    Four         firstBuf;       /* index of the first buffer of this partition */
+    Four         nBufs;          /* # of buffers in this partition */
+    Four         firstHashEntry; /* index of the first hash table entry of this partition */
+    Four         hashTableSize;  /* # of hash table entries of this partition */
+    char         pad[BFM_CACHE_LINE_SIZE - sizeof(UFour) - 4*sizeof(Four)];
+} bfmPartition;
+
+
 /* type definition for buffer pool information */
 typedef struct {
     Two          bufSize;	/* size of a buffer in page size */
@@ -180,7 +203,10 @@ typedef struct {
     LOGICAL_PTR_TYPE(char *) bufferPool; /* a set of buffers */
     LOGICAL_PTR_TYPE(bfmHashEntry *) hashTable;	/* hash table */
 
-    UFour        nextVictim;     /* index of NextVictim in Buffer */
+    Four         nPartitions;    /* # of partitions of this buffer pool */
+    bfmPartition partition[MAX_BFM_PARTITIONS]; /* partitions of this buffer pool */
+
+    Four         nCleanBufs;     /* # of buffers the cleaner keeps clean ahead of nextVictim */
 } BufferInfo;
 
 
@@ -231,6 +257,7 @@ END_MACRO
  */
 typedef struct {
     BufferInfo	bufInfo[NUM_BUF_TYPES];
+    Boolean	cleanerOn;	/* TRUE if the demon is cleaning the buffer pools */
 } BfM_SHM;
 
 extern BfM_SHM *bfm_shmPtr;
@@ -243,7 +270,15 @@ extern Four procIndex;
 #define BI_BUFTABLE(type)	 (bfm_shmPtr->bufInfo[type].bufTable)
 #define BI_BTENTRY(type, idx)    (((BufTBLEntry*)PHYSICAL_PTR(bfm_shmPtr->bufInfo[type].bufTable))[idx]) 
 
-#define BI_NEXTVICTIM(type)      (bfm_shmPtr->bufInfo[type].nextVictim)
+/* for buffer pool partitions */
+#define BI_NPARTITIONS(type)     (bfm_shmPtr->bufInfo[type].nPartitions)
+#define BI_PARTITION(type, p)    (bfm_shmPtr->bufInfo[type].partition[p])
+#define BI_NEXTVICTIM(type, p)   (BI_PARTITION(type, p).nextVictim)
+#define BI_NCLEANBUFS(type)      (bfm_shmPtr->bufInfo[type].nCleanBufs)
+
+/* for the buffer cleaner */
+#define BFM_CLEANER_ON           (bfm_shmPtr->cleanerOn)
+#define BFM_IS_CLEANED_BY_DEMON(type) (BFM_CLEANER_ON && BI_NCLEANBUFS(type) > 0)
 
 /* for buffer pool */
 #define BI_BUFFERPOOL(type)	 (bfm_shmPtr->bufInfo[type].bufferPool)
@@ -262,8 +297,9 @@ extern Four procIndex;
  * in order to minimize the rate of collisions.
  * Each entry of the hash table corresponds to an index of the buffer pool
  * as well as the buffer table.
+ * Each partition has (# of buffers in the partition)*4 + 1 entries.
  */
-#define HASHTABLESIZE(type)             (BI_NBUFS(type)*4 + 1)
+#define HASHTABLESIZE(type)             (BI_NBUFS(type)*4 + BI_NPARTITIONS(type))
 #define BFM_LOCKHASHTABLESIZE(type)     (BI_NBUFS(type)*5 + 1)
 #define BFM_LOCK_CB_POOLSIZE(type)      (BI_NBUFS(type)*3 + 1) 
 /*** END_OF_SHM_RELATED_AREA ***/
@@ -271,7 +307,7 @@ extern Four procIndex;
 /*
  * Function Prototypes
  */
-Four bfm_allocBuffer(Four, Four, BufTBLEntry **);
+Four bfm_allocBuffer(Four, Four, BfMHashKey *, BufTBLEntry **);
 Four bfm_delete(Four, BufTBLEntry *, Four);
 Four bfm_finalBufferInfo(Four, Four);
 Four bfm_flushBuffer(Four, BufTBLEntry *, Four);
@@ -300,6 +336,9 @@ Four BfM_LogDirtyPageTableEntries(Four);
 Four BfM_readTrain(Four, TrainID *, char *, Four); 
 Four BfM_RemoveLogPages(Four);
 Four BfM_RemoveTrain(Four, TrainID*, Four, Boolean); 
+Four BfM_InitCleaner(Four);
+Four BfM_FinalCleaner(Four);
+Four BfM_CleanBuffers(Four, Four);
 
 /* reduce # of useless function call request in COSMOS-CC/SINGLE */
 #ifndef SINGLE_USER
@@ -550,6 +550,7 @@ Four RDsM_MountWithDeviceListString(Four, char*, Four*, Boolean);
 Four RDsM_Dismount(Four, Four, Boolean);
 Four RDsM_DismountDataVolumes(Four);
 Four RDsM_LogMountedVols(Four);
+Four RDsM_OpenMountedVolumes(Four);
 
 Four RDsM_CreateSegment(Four, XactTableEntry_T*, Four, SegmentID_T*, Four, LogParameter_T*);
 Four RDsM_DropSegment(Four, XactTableEntry_T*, Four, SegmentID_T*, Four, Boolean, LogParameter_T*);
@@ -221,6 +221,11 @@ typedef MEMORY_ALIGN_TYPE LogicalPtr_T;
  */
 typedef struct CfgParams_T_tag {
     char logVolumeDeviceList[MAX_DEVICE_NAME_SIZE*MAX_DEVICES_IN_LOG_VOLUME]; /* log device name */
+    Four bfmNumCleanPageBufs;   /* # of page buffers the cleaner keeps clean (0: cleaner off) */
+    Four bfmNumCleanTrainBufs;  /* # of train buffers the cleaner keeps clean (0: cleaner off) */
+    Four bfmCleanerBatchSize;   /* max # of contiguous trains written by one cleaner I/O */
+    Four bfmCleanerInterval;    /* interval between cleaning passes (in milliseconds) */
+    Four bfmNumPartitions;      /* # of partitions of each buffer pool */
 } CfgParams_T;
 
 
@@ -1057,6 +1062,11 @@ extern Four procIndex;
 
 
 #define CFG_LOGVOLUMEDEVICELIST (common_shmPtr->cfgParams.logVolumeDeviceList)
+#define CFG_BFMNUMCLEANPAGEBUFS  (common_shmPtr->cfgParams.bfmNumCleanPageBufs)
+#define CFG_BFMNUMCLEANTRAINBUFS (common_shmPtr->cfgParams.bfmNumCleanTrainBufs)
+#define CFG_BFMCLEANERBATCHSIZE  (common_shmPtr->cfgParams.bfmCleanerBatchSize)
+#define CFG_BFMCLEANERINTERVAL   (common_shmPtr->cfgParams.bfmCleanerInterval)
+#define CFG_BFMNUMPARTITIONS     (common_shmPtr->cfgParams.bfmNumPartitions)
 
 /*** END_OF_SHM_RELATED_AREA ***/
 
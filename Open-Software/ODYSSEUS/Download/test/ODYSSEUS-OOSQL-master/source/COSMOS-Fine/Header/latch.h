@@ -177,5 +177,18 @@ Four SHM_releaseMyLatches(Four, Four);
 #define SHM_releaseMyLatches(_handle, _x)                (eNOERROR)
 #endif
 
+/*
+ * Atomic fetch-and-add on a word in the shared memory.
+ * It returns the value before the addition.
+ */
+#if defined(__GNUC__) && !defined(SINGLE_USER)
+#define SHM_FETCH_AND_ADD(_ptr, _v)    __sync_fetch_and_add((_ptr), (_v))
+#elif defined(WIN32) && !defined(SINGLE_USER)
+#define SHM_FETCH_AND_ADD(_ptr, _v)    InterlockedExchangeAdd((LONG volatile *)(_ptr), (LONG)(_v))
+#else
+/* not atomic; use only where a lost update is harmless */
+#define SHM_FETCH_AND_ADD(_ptr, _v)    ((*(_ptr) += (_v)) - (_v))
+#endif
+
 #endif /* __LATCH_H__ */
 
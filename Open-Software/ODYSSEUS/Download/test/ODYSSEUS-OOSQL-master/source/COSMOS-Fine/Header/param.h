@@ -193,6 +193,18 @@
 #define NUM_PAGE_BUFS     3000	
 #define NUM_LOT_LEAF_BUFS 4000  
 
+/* buffer cleaner run by the demon process (configuration parameter defaults) */
+#define BFM_DEFAULT_NUM_CLEAN_PAGE_BUFS     (NUM_PAGE_BUFS/10)     /* # of page buffers kept clean ahead of the victim pointer */
+#define BFM_DEFAULT_NUM_CLEAN_TRAIN_BUFS    (NUM_LOT_LEAF_BUFS/10) /* # of train buffers kept clean ahead of the victim pointer */
+#define BFM_DEFAULT_CLEANER_BATCH_SIZE      16                     /* max # of contiguous trains written at once */
+#define BFM_DEFAULT_CLEANER_INTERVAL        100                    /* interval between cleaning passes (in milliseconds) */
+
+/* partitions of a buffer pool; each partition has its own victim pointer and hash table */
+#define MAX_BFM_PARTITIONS                  64     /* max # of partitions of a buffer pool */
+#define BFM_MIN_BUFS_PER_PARTITION          64     /* min # of buffers in a partition */
+#define BFM_DEFAULT_NUM_PARTITIONS          8      /* # of partitions of a buffer pool (configuration parameter default) */
+#define BFM_CACHE_LINE_SIZE                 64     /* partitions are padded to the cache line size */
+
 /*
 ** BtM
 */
@@ -210,6 +210,11 @@ typedef struct BfM_PerThreadDS_T_tag {
     Buffer_ACC_CB  		MyFixed_BACB; /* pointer to the doubly linked list of BCBs which are fixed by this process  */
     Lock_ctrlBlock 		*myLCB;
 
+    /* used only by the buffer cleaner in the demon process */
+    BufTBLEntry			**cleanEntries; /* buffers pinned during a cleaning pass */
+    char			*cleanBuf;      /* allocated write buffer */
+    char			*alignedCleanBuf; /* aligned start of 'cleanBuf' */
+
 } BfM_PerThreadDS_T;
 
 /* LOGper Thread Data Structures */
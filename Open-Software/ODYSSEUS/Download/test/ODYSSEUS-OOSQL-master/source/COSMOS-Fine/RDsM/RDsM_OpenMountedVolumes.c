@@ -0,0 +1,197 @@
+/******************************************************************************/
+/*                                                                            */
+/*    Copyright (c) 1990-2016, KAIST                                          */
+/*    All rights reserved.                                                    */
+/*                                                                            */
+/*    Redistribution and use in source and binary forms, with or without      */
+/*    modification, are permitted provided that the following conditions      */
+/*    are met:                                                                */
+/*                                                                            */
+/*    1. Redistributions of source code must retain the above copyright       */
+/*       notice, this list of conditions and the following disclaimer.        */
+/*                                                                            */
+/*    2. Redistributions in binary form must reproduce the above copyright    */
+/*       notice, this list of conditions and the following disclaimer in      */
+/*       the documentation and/or other materials provided with the           */
+/*       distribution.                                                        */
+/*                                                                            */
+/*    3. Neither the name of the copyright holder nor the names of its        */
+/*       contributors may be used to endorse or promote products derived      */
+/*       from this software without specific prior written permission.        */
+/*                                                                            */
+/*    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS     */
+/*    "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT       */
+/*    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS       */
+/*    FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE          */
+/*    COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,    */
+/*    INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,    */
+/*    BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;        */
+/*    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER        */
+/*    CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT      */
+/*    LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN       */
+/*    ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE         */
+/*    POSSIBILITY OF SUCH DAMAGE.                                             */
+/*                                                                            */
+/******************************************************************************/
+/******************************************************************************/
+/*                                                                            */
+/*    ODYSSEUS/COSMOS General-Purpose Large-Scale Object Storage System --    */
+/*    Fine-Granule Locking Version                                            */
+/*    Version 3.0                                                             */
+/*                                                                            */
+/*    Developed by Professor Kyu-Young Whang et al.                           */
+/*                                                                            */
+/*    Advanced Information Technology Research Center (AITrc)                 */
+/*    Korea Advanced Institute of Science and Technology (KAIST)              */
+/*                                                                            */
+/*    e-mail: odysseus.oosql@gmail.com                                        */
+/*                                                                            */
+/*    Bibliography:                                                           */
+/*    [1] Whang, K., Lee, J., Lee, M., Han, W., Kim, M., and Kim, J., "DB-IR  */
+/*        Integration Using Tight-Coupling in the Odysseus DBMS," World Wide  */
+/*        Web, Vol. 18, No. 3, pp. 491-520, May 2015.                         */
+/*    [2] Whang, K., Lee, M., Lee, J., Kim, M., and Han, W., "Odysseus: a     */
+/*        High-Performance ORDBMS Tightly-Coupled with IR Features," In Proc. */
+/*        IEEE 21st Int'l Conf. on Data Engineering (ICDE), pp. 1104-1105     */
+/*        (demo), Tokyo, Japan, April 5-8, 2005. This paper received the Best */
+/*        Demonstration Award.                                                */
+/*    [3] Whang, K., Park, B., Han, W., and Lee, Y., "An Inverted Index       */
+/*        Storage Structure Using Subindexes and Large Objects for Tight      */
+/*        Coupling of Information Retrieval with Database Management          */
+/*        Systems," U.S. Patent No.6,349,308 (2002) (Appl. No. 09/250,487     */
+/*        (1999)).                                                            */
+/*    [4] Whang, K., Lee, J., Kim, M., Lee, M., Lee, K., Han, W., and Kim,    */
+/*        J., "Tightly-Coupled Spatial Database Features in the               */
+/*        Odysseus/OpenGIS DBMS for High-Performance," GeoInformatica,        */
+/*        Vol. 14, No. 4, pp. 425-446, Oct. 2010.                             */
+/*    [5] Whang, K., Lee, J., Kim, M., Lee, M., and Lee, K., "Odysseus: a     */
+/*        High-Performance ORDBMS Tightly-Coupled with Spatial Database       */
+/*        Features," In Proc. 23rd IEEE Int'l Conf. on Data Engineering       */
+/*        (ICDE), pp. 1493-1494 (demo), Istanbul, Turkey, Apr. 16-20, 2007.   */
+/*                                                                            */
+/******************************************************************************/
+/*
+ * Module: RDsM_OpenMountedVolumes.c
+ *
+ * Description:
+ *  Open the devices of the volumes mounted by other processes.
+ *
+ * Exports:
+ *  Four RDsM_OpenMountedVolumes(Four)
+ */
+
+
+#include <fcntl.h>
+#ifndef WIN32
+#include <unistd.h>
+#else
+#include <windows.h>
+#endif /* WIN32 */
+#include "common.h"
+#include "trace.h"
+#include "error.h"
+#include "latch.h"
+#include "SHM.h"
+#include "RDsM.h"
+#include "Util_varArray.h"
+#include "perProcessDS.h"
+#include "perThreadDS.h"
+
+
+
+
+/*
+ * Function: Four RDsM_OpenMountedVolumes(Four)
+ *
+ * Description:
+ *   Synchronize the user volume table of the given handle with the shared
+ *   volume table: the devices of the volumes dismounted meanwhile are closed
+ *   and the devices of the newly mounted volumes are opened so that the
+ *   handle can read and write their pages.
+ *   Unlike RDsM_Mount(), the mount counts are not changed; this is used by
+ *   the demon process, which writes the buffers on behalf of the servers
+ *   but never mounts a volume by itself.
+ *
+ * Returns:
+ *  Error code
+ */
+Four RDsM_OpenMountedVolumes(
+    Four                 handle)                  /* IN    handle */
+{
+    Four                 e;                       /* error code */
+    Four                 i, j;                    /* loop variable */
+    FileDesc             fd;                      /* open file descriptor */
+    RDsM_DevInfo         *devInfo;                /* device information in volume table entry */
+    rdsm_UserVolTableEntry_T *userEntry;          /* user volume table entry */
+    rdsm_VolTableEntry_T *entry;                  /* volume table entry */
+
+
+    TR_PRINT(handle, TR_RDSM, TR1, ("RDsM_OpenMountedVolumes()"));
+
+
+    for (i = 0; i < MAXNUMOFVOLS; i++) {
+
+        entry = &RDSM_VOLTABLE[i];
+        userEntry = &RDSM_USERVOLTABLE(handle)[i];
+
+        /* Mutex Begin :: Volume Table Entry  */
+        e = SHM_getLatch(handle, &entry->latch, procIndex, M_SHARED, M_UNCONDITIONAL, NULL);
+        if (e < eNOERROR) ERR(handle, e);
+
+        /*
+         * close the devices of the volume dismounted meanwhile
+         */
+        if (userEntry->volNo != NOVOL && userEntry->volNo != entry->volInfo.volNo) {
+
+            for (j = 0; j < userEntry->numDevices; j++) {
+#ifndef WIN32
+                if (close(OPENFILEDESC_ARRAY(userEntry->openFileDesc)[j]) == -1) ERRL1(handle, eDEVICECLOSEFAIL_RDSM, &entry->latch);
+#else
+                if (CloseHandle(OPENFILEDESC_ARRAY(userEntry->openFileDesc)[j]) == 0) ERRL1(handle, eDEVICECLOSEFAIL_RDSM, &entry->latch);
+#endif /* WIN32 */
+            }
+
+            userEntry->volNo = NOVOL;
+        }
+
+        /*
+         * open the devices of the newly mounted volume
+         */
+        if (entry->volInfo.volNo != NOVOL && userEntry->volNo == NOVOL) {
+
+            devInfo = PHYSICAL_PTR(entry->volInfo.devInfo);
+
+            for (j = 0; j < entry->volInfo.numDevices; j++) {
+
+                /* doubling openFileDesc array if needed */
+                if (j >= userEntry->openFileDesc.nEntries) {
+                    e = Util_doublesizeVarArray(handle, &userEntry->openFileDesc, sizeof(FileDesc));
+                    if (e < eNOERROR) ERRL1(handle, e, &entry->latch);
+                }
+
+#ifndef WIN32
+#ifndef _LARGEFILE64_SOURCE
+                if ((fd = open(devInfo[j].devName, O_RDWR | O_SYNC)) == -1) ERRL1(handle, eDEVICEOPENFAIL_RDSM, &entry->latch);
+#else
+                if ((fd = open64(devInfo[j].devName, O_RDWR | O_SYNC)) == -1) ERRL1(handle, eDEVICEOPENFAIL_RDSM, &entry->latch);
+#endif
+#else
+                if ((fd = CreateFile(devInfo[j].devName, GENERIC_WRITE | GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                                     OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_NO_BUFFERING, NULL)) == INVALID_HANDLE_VALUE) ERRL1(handle, eDEVICEOPENFAIL_RDSM, &entry->latch);
+#endif /* WIN32 */
+
+                OPENFILEDESC_ARRAY(userEntry->openFileDesc)[j] = fd;
+            }
+
+            userEntry->volNo = entry->volInfo.volNo;
+            userEntry->numDevices = entry->volInfo.numDevices;
+        }
+
+        /* Mutex End :: Volume Table Entry  */
+        e = SHM_releaseLatch(handle, &entry->latch, procIndex);
+        if (e < eNOERROR) ERR(handle, e);
+    }
+
+    return(eNOERROR);
+
+} /* RDsM_OpenMountedVolumes() */
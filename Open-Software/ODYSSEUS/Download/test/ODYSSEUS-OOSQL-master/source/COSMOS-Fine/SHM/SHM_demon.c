@@ -87,10 +87,13 @@
 #include <sys/shm.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <time.h>	/* for time */
 #include "common.h"
 #include "error.h"
 #include "trace.h"
 #include "SHM.h"
+#include "RDsM.h"
+#include "BfM.h"
 #include "perProcessDS.h"
 #include "perThreadDS.h"
 #include <errno.h>
@@ -99,6 +102,11 @@
 /* shm_initDemon :: initialize Demon Process */
 #define ST_DEADLOCKDETECTION 4
 
+/* set while the demon is cleaning the buffers; a signal must not kill it then */
+static volatile Boolean shm_demonBusy = FALSE;
+static volatile Four shm_demonExitSignal = 0;
+static Four shm_demonHandle;
+
 
 void shm_signalHandlerOfDemon();
 void shm_signalHandlerOfServer();
@@ -118,6 +126,7 @@ Four SHM_initDemon(
     char        semName[MAXSEMAPHORENAME];
     Four        tmp;
     FileDesc    fd_1, fd_2, fd_3; 
+    time_t      lastDetection;		/* last time of the deadlock detection */
 
     signal(SIGTRAP, SIG_IGN);
     signal(SIGCHLD, shm_signalHandlerOfServer); 
@@ -188,9 +197,39 @@ Four SHM_initDemon(
 	CLOSE_LOCK_FILE_DESC_FOR_SHARED_MEMORY_ACCESS(fd_2);
 	CLOSE_LOCK_FILE_DESC_FOR_SHARED_MEMORY_ACCESS(fd_3);
 
+	/*@ start the buffer cleaner */
+	shm_demonHandle = handle;
+	e = BfM_InitCleaner(handle);
+	if (e < eNOERROR) ERR(handle, e);
+
+	lastDetection = time(NULL);
+
 	for(;;) {
 
-	    sleep(ST_DEADLOCKDETECTION);
+	    if (BFM_CLEANER_ON) {
+		usleep(CFG_BFMCLEANERINTERVAL*1000);
+
+		/*
+		 * Errors of the cleaner are not fatal; the servers write
+		 * the dirty buffers by themselves if the cleaner fails.
+		 */
+		shm_demonBusy = TRUE;
+
+		e = RDsM_OpenMountedVolumes(handle);
+		if (e >= eNOERROR) e = BfM_CleanBuffers(handle, PAGE_BUF);
+		if (e >= eNOERROR) e = BfM_CleanBuffers(handle, TRAIN_BUF);
+		if (e < eNOERROR)
+		    fprintf(stderr, "[%2ld] Demon Process(pid=%ld) Buffer cleaning failed: error %ld\n", procIndex, getpid(), e);
+
+		shm_demonBusy = FALSE;
+		if (shm_demonExitSignal != 0) shm_signalHandlerOfDemon(shm_demonExitSignal);
+
+		if (time(NULL) - lastDetection < ST_DEADLOCKDETECTION) continue;
+	    }
+	    else
+		sleep(ST_DEADLOCKDETECTION);
+
+	    lastDetection = time(NULL);
 
 	    e = LM_detectDeadlock(handle);
 	    if (e < eNOERROR) ERR(handle, e);
@@ -237,8 +276,17 @@ void shm_signalHandlerOfDemon(Four sigNo) /* change function name from shm_sigHa
     char        semName[MAXSEMAPHORENAME];
 
 
+    /* the buffers pinned by the cleaner should be released before exit */
+    if (shm_demonBusy) {
+	shm_demonExitSignal = sigNo;
+	return;
+    }
+
     fprintf(stderr, "[%2ld] Demon Process(pid=%ld) Destroyed by signal %ld\n", procIndex, getpid(), sigNo);
 
+    /* the servers write the dirty buffers by themselves from now on */
+    (void) BfM_FinalCleaner(shm_demonHandle);
+
 
     exit(0); /* DO NOT REMOVE THIS LINE */ 
 }
@@ -272,6 +320,7 @@ Four shm_initInheritedProperty(
 {
     Four                e;              /* error */
     Four                fd;
+    Four                i;              /* loop index */
 
 
     /* We close all opend file descriptors except stdard I/O (stdin, stdout, stderr) */
@@ -282,6 +331,10 @@ Four shm_initInheritedProperty(
             close(fd);
     }
 
+    /* The devices of the mounted volumes were closed above */
+    for (i = 0; i < MAXNUMOFVOLS; i++)
+        RDSM_USERVOLTABLE(handle)[i].volNo = NOVOL;
+
     /* We detach this demon process from the process group in order to prevent signal's effect */
     e = setpgrp();
     if (e == -1) ERR(handle, eINTERNAL);
@@ -82,6 +82,7 @@
 
 
 #include <string.h>
+#include <stdlib.h>
 #include "common.h"
 #include "error.h"
 #include "trace.h"
@@ -116,6 +117,29 @@ Four SM_SetCfgParam(
 
         strcpy(sm_cfgParams.logVolumeDeviceList, value);
 
+    } else if (strcmp(name, "BFM_NUM_CLEAN_PAGE_BUFS") == 0) {
+
+        sm_cfgParams.bfmNumCleanPageBufs = MAX(atol(value), 0);
+
+    } else if (strcmp(name, "BFM_NUM_CLEAN_TRAIN_BUFS") == 0) {
+
+        sm_cfgParams.bfmNumCleanTrainBufs = MAX(atol(value), 0);
+
+    } else if (strcmp(name, "BFM_CLEANER_BATCH_SIZE") == 0) {
+
+        if (atol(value) <= 0) ERR(handle, eBADPARAMETER);
+        sm_cfgParams.bfmCleanerBatchSize = atol(value);
+
+    } else if (strcmp(name, "BFM_CLEANER_INTERVAL") == 0) {
+
+        if (atol(value) <= 0) ERR(handle, eBADPARAMETER);
+        sm_cfgParams.bfmCleanerInterval = atol(value);
+
+    } else if (strcmp(name, "BFM_NUM_PARTITIONS") == 0) {
+
+        if (atol(value) <= 0 || atol(value) > MAX_BFM_PARTITIONS) ERR(handle, eBADPARAMETER);
+        sm_cfgParams.bfmNumPartitions = atol(value);
+
     } else if (strcmp(name, "COHERENCY_VOLUME_DEVICE") == 0) {
 
         /* needless in multi-user version */
@@ -103,7 +103,9 @@
 #include "perProcessDS.h"
 #include "perThreadDS.h"
 
-CfgParams_T sm_cfgParams = { "" };
+CfgParams_T sm_cfgParams = { "", BFM_DEFAULT_NUM_CLEAN_PAGE_BUFS, BFM_DEFAULT_NUM_CLEAN_TRAIN_BUFS,
+                              BFM_DEFAULT_CLEANER_BATCH_SIZE, BFM_DEFAULT_CLEANER_INTERVAL,
+                              BFM_DEFAULT_NUM_PARTITIONS };
 
 
 